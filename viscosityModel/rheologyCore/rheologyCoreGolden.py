@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""
+Generate rheologyCoreGolden.H, the reference values of rheologyCoreTest.
+
+The viscosities are computed with the formulas of the post-processing
+scripts of the repository, transcribed here with the standard math module
+so that no numpy, pandas or matplotlib is needed:
+
+    TimeSlurryViscosity.calculate_viscosity     ../../TimeSlurryViscosity.py
+        nu = min(nuMax, (tau0 + k*t**timeCoeff*gamma**n)/gamma),
+        gamma = max(sr, 1e-6)
+    TimeVaryingGroutCalculator.calculate_nu
+        ../../testTut/twoPhaseBox_timeSlurry/calculate_nu.py
+        nu = min(nuMax, (tau0 + k*exp(timeCoeff*t)*sr**n)/sr)
+    analyze_kEffective_evolution                ../timeVaryingGrout/Nu_effect.py
+        kEffective = min(nuMax, k*exp(timeCoeff*t))
+
+The newtonian yield law is the k(t) of the scripts alone
+(calculate_viscosity with tau0 = 0 and gamma = 1, or kEffective). None of
+the scripts has the Papanastasiou law: its yield term is written out from
+timeVaryingGrout (scale*(tau0*(1 - exp(-m*sr))/sr + k*sr**(n - 1)), and
+scale*tau0*m at sr = 0) on top of the k(t) of the scripts.
+
+Usage: python3 rheologyCoreGolden.py > rheologyCoreGolden.H
+"""
+
+import math
+
+# Coefficients of the example in TimeSlurryViscosity.py
+SLURRY = dict(k=0.01136, n=0.8751, tau0=0.00000178571, nuMax=1e-1,
+              timeCoeff=1.23)
+
+# Coefficients of testTut/twoPhaseBox_timeSlurry/constant/transportProperties
+GROUT = dict(k=0.4172, n=0.8751, tau0=50, nuMax=1, timeCoeff=0.0009,
+             m=1000, rho=1400)
+
+SLURRY_TIMES = [0, 0.5, 1, 10, 60, 600, 3600]
+GROUT_TIMES = [0, 1, 10, 60, 600, 1800, 3600, 10000]
+
+CLIPPED_SR = [1e-6, 1e-4, 1e-3, 0.01, 0.1, 0.5, 1, 2, 10, 100, 1e3, 1e4]
+PAPANASTASIOU_SR = [0, 1e-5, 1e-4, 1e-3, 0.01, 0.1, 1, 10, 100, 1e3]
+
+GREAT = 1e15
+VSMALL = 1e-300
+
+
+def calculate_viscosity(p, t, gamma_dot):
+    """TimeSlurryViscosity.calculate_viscosity"""
+    time_term = p['k']*(t**p['timeCoeff'])
+    gamma = gamma_dot if gamma_dot > 1e-6 else 1e-6
+    nu = (p['tau0'] + time_term*(gamma**p['n']))/gamma
+    return min(nu, p['nuMax'])
+
+
+def calculate_nu(p, sr_limited, time):
+    """TimeVaryingGroutCalculator.calculate_nu"""
+    numerator = p['tau0'] + p['k']*math.exp(p['timeCoeff']*time) \
+        *sr_limited**p['n']
+    return min(numerator/sr_limited, p['nuMax'])
+
+
+def kEffective(p, t):
+    """analyze_kEffective_evolution"""
+    return min(p['nuMax'], p['k']*math.exp(p['timeCoeff']*t))
+
+
+def papanastasiou(tau0, m, n, scale, k, sr):
+    if sr == 0:
+        return scale*tau0*m
+    return scale*(tau0*(1 - math.exp(-m*sr))/sr + k*sr**(n - 1))
+
+
+def laws():
+    """(source, timeLaw, yieldLaw, coeffs, times, srs, nu(t, sr))"""
+    constant = dict(SLURRY, timeCoeff=0)
+    newtonian = dict(tau0=0)
+
+    yield_coeffs = dict(n=GROUT['n'], tau0=GROUT['tau0'], m=GROUT['m'])
+
+    return [
+        (
+            'TimeSlurryViscosity.py', 'constant', 'newtonian',
+            dict(k=SLURRY['k'], nuMax=SLURRY['nuMax']),
+            SLURRY_TIMES, CLIPPED_SR,
+            lambda t, sr: calculate_viscosity(dict(constant, **newtonian), t, 1)
+        ),
+        (
+            'TimeSlurryViscosity.py', 'power', 'newtonian',
+            dict(k=SLURRY['k'], timeCoeff=SLURRY['timeCoeff'],
+                 nuMax=SLURRY['nuMax']),
+            SLURRY_TIMES, CLIPPED_SR,
+            lambda t, sr: calculate_viscosity(dict(SLURRY, **newtonian), t, 1)
+        ),
+        (
+            'Nu_effect.py', 'exponential', 'newtonian',
+            dict(k=GROUT['k'], timeCoeff=GROUT['timeCoeff'],
+                 kMax=GROUT['nuMax']),
+            GROUT_TIMES, CLIPPED_SR,
+            lambda t, sr: kEffective(GROUT, t)
+        ),
+        (
+            'TimeSlurryViscosity.py', 'constant', 'clipped',
+            dict(k=SLURRY['k'], n=SLURRY['n'], tau0=SLURRY['tau0'],
+                 srMin=1e-6, nuMax=SLURRY['nuMax']),
+            SLURRY_TIMES, CLIPPED_SR,
+            lambda t, sr: calculate_viscosity(constant, t, sr)
+        ),
+        (
+            'TimeSlurryViscosity.py', 'power', 'clipped',
+            dict(k=SLURRY['k'], timeCoeff=SLURRY['timeCoeff'],
+                 n=SLURRY['n'], tau0=SLURRY['tau0'], srMin=1e-6,
+                 nuMax=SLURRY['nuMax']),
+            SLURRY_TIMES, CLIPPED_SR,
+            lambda t, sr: calculate_viscosity(SLURRY, t, sr)
+        ),
+        (
+            'calculate_nu.py', 'exponential', 'clipped',
+            dict(k=GROUT['k'], timeCoeff=GROUT['timeCoeff'], n=GROUT['n'],
+                 tau0=GROUT['tau0'], nuMax=GROUT['nuMax']),
+            GROUT_TIMES, CLIPPED_SR,
+            lambda t, sr: calculate_nu(GROUT, sr, t)
+        ),
+        (
+            'TimeSlurryViscosity.py', 'constant', 'papanastasiou',
+            dict(yield_coeffs, k=SLURRY['k']),
+            SLURRY_TIMES, PAPANASTASIOU_SR,
+            lambda t, sr: papanastasiou
+            (
+                GROUT['tau0'], GROUT['m'], GROUT['n'], 1,
+                calculate_viscosity(dict(constant, **newtonian), t, 1), sr
+            )
+        ),
+        (
+            'TimeSlurryViscosity.py', 'power', 'papanastasiou',
+            dict(yield_coeffs, k=SLURRY['k'], timeCoeff=SLURRY['timeCoeff'],
+                 kMax=SLURRY['nuMax']),
+            SLURRY_TIMES, PAPANASTASIOU_SR,
+            lambda t, sr: papanastasiou
+            (
+                GROUT['tau0'], GROUT['m'], GROUT['n'], 1,
+                calculate_viscosity(dict(SLURRY, **newtonian), t, 1), sr
+            )
+        ),
+        (
+            'Nu_effect.py', 'exponential', 'papanastasiou',
+            dict(yield_coeffs, k=GROUT['k'], timeCoeff=GROUT['timeCoeff'],
+                 kMax=GROUT['nuMax'], scale=0.5*GROUT['rho']),
+            GROUT_TIMES, PAPANASTASIOU_SR,
+            lambda t, sr: papanastasiou
+            (
+                GROUT['tau0'], GROUT['m'], GROUT['n'], 0.5*GROUT['rho'],
+                kEffective(GROUT, t), sr
+            )
+        ),
+    ]
+
+
+COEFFS = [
+    ('k', 0), ('k0', 0), ('timeCoeff', 0), ('kMax', GREAT), ('n', 1),
+    ('tau0', 0), ('srMin', VSMALL), ('m', 1000), ('scale', 1),
+    ('nuMin', 0), ('nuMax', GREAT)
+]
+
+
+def main():
+    out = []
+    w = out.append
+
+    w('// Generated by rheologyCoreGolden.py, do not edit.')
+    w('// Coefficients in the order of rheologyCore::coeffs:')
+    w('// ' + ', '.join(name for name, _ in COEFFS))
+    w('')
+    w('#ifndef rheologyCoreGolden_H')
+    w('#define rheologyCoreGolden_H')
+    w('')
+    w('namespace golden')
+    w('{')
+    w('')
+    w('struct law')
+    w('{')
+    w('    const char* source;')
+    w('    const char* timeLaw;')
+    w('    const char* yieldLaw;')
+    w('    double coeffs[%d];' % len(COEFFS))
+    w('    int nTimes;')
+    w('    int nStrainRates;')
+    w('    const double* times;')
+    w('    const double* strainRates;')
+    w('    const double* nu;     //!< nTimes x nStrainRates, sr contiguous')
+    w('};')
+    w('')
+
+    entries = []
+    for i, (source, timeLaw, yieldLaw, c, times, srs, nu) in \
+            enumerate(laws()):
+        w('const double times%d[] = { %s };'
+          % (i, ', '.join(repr(float(t)) for t in times)))
+        w('const double strainRates%d[] = { %s };'
+          % (i, ', '.join(repr(float(sr)) for sr in srs)))
+        w('const double nu%d[] =' % i)
+        w('{')
+        for t in times:
+            w('    ' + ', '.join(repr(nu(t, sr)) for sr in srs) + ',')
+        w('};')
+        w('')
+
+        values = ', '.join(repr(float(c.get(name, deflt)))
+                           for name, deflt in COEFFS)
+        entries.append(
+            '    { "%s", "%s", "%s", { %s }, %d, %d, times%d, strainRates%d,'
+            ' nu%d },'
+            % (source, timeLaw, yieldLaw, values, len(times), len(srs),
+               i, i, i))
+
+    w('const law laws[] =')
+    w('{')
+    out.extend(entries)
+    w('};')
+    w('')
+    w('const int nLaws = sizeof(laws)/sizeof(laws[0]);')
+    w('')
+    w('} // End namespace golden')
+    w('')
+    w('#endif')
+
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,14 @@
+# Flags that let the rheologyCore.H loops vectorise, shared by the Makefile
+# in this directory and the wmake Make/options of the viscosity models.
+#
+# exp and pow must not set errno or be treated as trapping to be evaluated
+# in vector lanes. On x86_64 Linux the vector versions come from glibc
+# libmvec.
+
+RHEOLOGYCORE_VECTOR_FLAGS = -fno-math-errno -fno-trapping-math
+RHEOLOGYCORE_VECTOR_LIBS =
+
+ifeq ($(shell uname -s)-$(shell uname -m),Linux-x86_64)
+    RHEOLOGYCORE_VECTOR_FLAGS += -DRHEOLOGYCORE_LIBMVEC
+    RHEOLOGYCORE_VECTOR_LIBS += -lmvec
+endif